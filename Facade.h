@@ -0,0 +1,370 @@
+/* To solve a complex problem, often we break down it to smaller pieces. In the process we might have a bunch of components represented
+   as vairous classes. For a client who does not want to get involved in the nitty gritty of the inter-dependancy of these components,
+   an easier interface can be provided. This interface is Facade
+*/
+
+/* In the example below, an user instructs an autonomus car to drive to destination, D.
+   Notice that the Facade class is just like a wrapper, encapsulating various elements of the subsystem.
+   The sybsystem is still open to be accessed individually, for the clients who needs it
+*/
+
+#ifndef FACADE_H
+#define FACADE_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <list>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Trace.h"
+
+
+class Doors
+{
+public:
+	bool AreDoorsClosed() { std::cout << " Checking whether doors are closed " << std::endl; return true; }
+	bool CloseDoors() { std::cout << " Closing the doors " << std::endl; return true; }
+	bool OpenDoors() { std::cout << " Opening the doors " << std::endl; return true; }
+};
+
+class SeatBeltSensors
+{
+public:
+	bool AreSeatBeltsFastened() { std::cout << " Checking Passenger occupancy" << std::endl << " Checking SeatBelt Fasten sensor " << std::endl; return true;}
+};
+
+/* Reading the doors and seat belt sensors is slow, and many callers ask whether it is safe at the same time.
+   Safety caches the last known state. Sensor change events update it as they happen, and the hardware is read only
+   when the cached state is older than the staleness window. Callers that find a read already in flight wait for
+   its result instead of reading the hardware again (single flight)
+*/
+class Safety
+{
+public:
+	Safety(std::chrono::milliseconds maxStaleness = std::chrono::milliseconds(100))
+		: _maxStaleness(maxStaleness), _doorsClosed(false), _seatBeltsFastened(false), _readInFlight(false), _readsDone(0) { }
+	
+	bool IsSafeForDrive()
+	{
+		TRACE_SPAN("Safety::IsSafeForDrive");
+		std::unique_lock<std::mutex> lock(_mutex);
+		for(;;)
+		{
+			if(IsFresh())
+				return _doorsClosed && _seatBeltsFastened;
+			if(!_readInFlight)
+				break;
+			
+			unsigned long readsDone = _readsDone;
+			_readDone.wait(lock, [this]() { return !_readInFlight; });
+			if(_readsDone != readsDone)
+				return _doorsClosed && _seatBeltsFastened;
+			// The read we waited for failed. Go round again, we may have to read the hardware ourselves
+		}
+		
+		// We are the one reading the hardware. Don't hold the lock while doing so
+		_readInFlight = true;
+		auto readStarted = std::chrono::steady_clock::now();
+		lock.unlock();
+		bool doorsClosed, seatBeltsFastened;
+		try
+		{
+			doorsClosed = _doors.AreDoorsClosed();
+			seatBeltsFastened = _seatBeltSensor.AreSeatBeltsFastened();
+		}
+		catch(...)
+		{
+			lock.lock();
+			_readInFlight = false;
+			_readDone.notify_all();
+			throw;
+		}
+		lock.lock();
+		
+		// A change event that arrived while we were reading is newer than what we read. Keep it
+		if(_doorsUpdated < readStarted)
+		{
+			_doorsClosed = doorsClosed;
+			_doorsUpdated = readStarted;
+		}
+		if(_seatBeltsUpdated < readStarted)
+		{
+			_seatBeltsFastened = seatBeltsFastened;
+			_seatBeltsUpdated = readStarted;
+		}
+		++_readsDone;
+		_readInFlight = false;
+		_readDone.notify_all();
+		return _doorsClosed && _seatBeltsFastened;
+	}
+	
+	// Sensor change events. They keep the cached state current without a hardware read
+	void OnDoorsChanged(bool closed)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_doorsClosed = closed;
+		_doorsUpdated = std::chrono::steady_clock::now();
+	}
+	
+	void OnSeatBeltsChanged(bool fastened)
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_seatBeltsFastened = fastened;
+		_seatBeltsUpdated = std::chrono::steady_clock::now();
+	}
+	
+	// Number of completed hardware reads, to see how well concurrent callers are coalesced
+	unsigned long HardwareReads()
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		return _readsDone;
+	}
+	
+private:
+	bool IsFresh() const // call with _mutex held
+	{
+		auto oldest = std::min(_doorsUpdated, _seatBeltsUpdated);
+		return std::chrono::steady_clock::now() - oldest <= _maxStaleness;
+	}
+	
+	Doors _doors;
+	SeatBeltSensors _seatBeltSensor;
+	
+	std::chrono::milliseconds _maxStaleness;
+	std::mutex _mutex;
+	std::condition_variable _readDone;
+	bool _doorsClosed;
+	bool _seatBeltsFastened;
+	std::chrono::steady_clock::time_point _doorsUpdated; // default is the clock's epoch, i.e. stale
+	std::chrono::steady_clock::time_point _seatBeltsUpdated;
+	bool _readInFlight;
+	unsigned long _readsDone;
+};	
+
+/* Our fleet keeps driving to the same few destinations, so the Map remembers the routes it has already found.
+   The cache is keyed by (origin, destination) and bounded; when it is full, the least recently used route is dropped.
+   The current location is also remembered, so GPS is contacted only when the location is invalidated (i.e. the car moved)
+*/
+class Map
+{
+public:
+	Map(std::size_t routeCacheSize = 8) : _routeCacheSize(routeCacheSize), _hasLocation(false) { }
+	
+	bool FindRoute(const std::string& destination = "Mars")
+	{
+		TRACE_SPAN("Map::FindRoute");
+		RouteKey key(GetCurrentLocation(), destination);
+		auto cached = _routeIndex.find(key);
+		if(cached != _routeIndex.end())
+		{
+			// Cache hit. Move the route to the front of the list, it is now the most recently used one
+			_routes.splice(_routes.begin(), _routes, cached->second);
+			std::cout << " Found cached route to destination " << std::endl;
+			return true;
+		}
+		
+		std::cout << " Find route to destination " << std::endl;
+		_routes.push_front(key);
+		_routeIndex[key] = _routes.begin();
+		if(_routes.size() > _routeCacheSize)
+		{
+			_routeIndex.erase(_routes.back());
+			_routes.pop_back();
+		}
+		return true;
+	} 
+	
+	const std::string& GetCurrentLocation()
+	{
+		if(!_hasLocation)
+		{
+			std::cout << " Contacting GPS and getting current location " << std::endl;
+			_location = "Earth";
+			_hasLocation = true;
+		}
+		return _location;
+	}
+	
+	void InvalidateLocation() { _hasLocation = false; }
+	
+private:
+	typedef std::pair<std::string, std::string> RouteKey; // (origin, destination)
+	
+	std::size_t _routeCacheSize;
+	std::list<RouteKey> _routes; // most recently used route at the front
+	std::map<RouteKey, std::list<RouteKey>::iterator> _routeIndex;
+	std::string _location;
+	bool _hasLocation;
+};
+
+struct SensorFrame
+{
+	unsigned long sequence;
+	std::chrono::steady_clock::time_point captured;
+	std::size_t size; // bytes of data that belong to this frame, the rest is left over from earlier frames
+	std::vector<unsigned char> data; // allocated once, never resized afterwards
+};
+
+/* Sensor frames are large and keep arriving, so they are never copied between the sensors and Drive.
+   Three frames are preallocated (triple buffering): the producer fills the back frame, the consumer reads the front frame,
+   and the middle slot holds the latest complete frame. Publishing and consuming are single atomic swaps, so neither side
+   ever waits for the other. When the consumer is slow, older frames are simply overwritten; Drive only wants the latest
+*/
+class SensorFrameBuffer
+{
+public:
+	SensorFrameBuffer(std::size_t frameSize) : _back(0), _middle(1), _front(2), _hasFrame(false)
+	{
+		for(auto& frame : _frames)
+		{
+			frame.sequence = 0;
+			frame.size = 0;
+			frame.data.resize(frameSize);
+		}
+	}
+	
+	// Producer side. Fill the back frame and then publish it
+	SensorFrame& BackFrame() { return _frames[_back]; }
+	void Publish() { _back = _middle.exchange(_back | FRESH, std::memory_order_acq_rel) & INDEX_MASK; }
+	
+	/* Consumer side. Returns the newest published frame, or the one returned last time if nothing new has arrived since;
+	   use its sequence or captured time to tell. Returns nullptr only before the first frame is published.
+	   The frame is borrowed, it stays valid until the next call
+	*/
+	const SensorFrame* LatestFrame()
+	{
+		if(_middle.load(std::memory_order_acquire) & FRESH)
+		{
+			_front = _middle.exchange(_front, std::memory_order_acq_rel) & INDEX_MASK;
+			_hasFrame = true;
+		}
+		return _hasFrame ? &_frames[_front] : nullptr;
+	}
+	
+private:
+	static const unsigned INDEX_MASK = 3;
+	static const unsigned FRESH = 4; // set in _middle when it holds a frame the consumer has not seen yet
+	
+	std::array<SensorFrame, 3> _frames;
+	unsigned _back;
+	std::atomic<unsigned> _middle;
+	unsigned _front;
+	bool _hasFrame;
+};
+
+// Replays a recording kept in memory as if it came from the sensors. Stands in for the real hardware while testing
+class SensorReplay
+{
+public:
+	SensorReplay(SensorFrameBuffer& buffer, std::vector<std::vector<unsigned char>> recording, std::chrono::microseconds framePeriod)
+		: _buffer(buffer), _recording(std::move(recording)), _framePeriod(framePeriod), _running(false)
+	{
+		if(_recording.empty())
+			throw std::invalid_argument("SensorReplay needs at least one recorded frame");
+	}
+	~SensorReplay() { Stop(); }
+	
+	void Start()
+	{
+		if(_producer.joinable()) // already running
+			return;
+		_running = true;
+		_producer = std::thread([this]() { Produce(); });
+	}
+	
+	void Stop()
+	{
+		_running = false;
+		if(_producer.joinable())
+			_producer.join();
+	}
+	
+private:
+	void Produce()
+	{
+		unsigned long sequence = 0;
+		while(_running)
+		{
+			const std::vector<unsigned char>& recorded = _recording[sequence % _recording.size()];
+			SensorFrame& frame = _buffer.BackFrame();
+			frame.size = std::min(recorded.size(), frame.data.size());
+			std::copy_n(recorded.begin(), frame.size, frame.data.begin());
+			frame.sequence = ++sequence;
+			frame.captured = std::chrono::steady_clock::now();
+			_buffer.Publish();
+			std::this_thread::sleep_for(_framePeriod);
+		}
+	}
+	
+	SensorFrameBuffer& _buffer;
+	std::vector<std::vector<unsigned char>> _recording;
+	std::chrono::microseconds _framePeriod;
+	std::atomic<bool> _running;
+	std::thread _producer;
+};
+
+class Drive
+{
+public:
+	// The frames belong to whoever feeds them, the sensors or a SensorReplay. Drive only reads them
+	Drive(SensorFrameBuffer& sensorFrames) : _sensorFrames(sensorFrames) { }
+	
+	// Never waits for the producer. Returns false only until the first frame has arrived
+	bool GetDataFromSensors()
+	{
+		const SensorFrame* frame = _sensorFrames.LatestFrame();
+		if(!frame)
+			return false;
+		auto latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - frame->captured);
+		std::cout << " Getting data from sensors. Frame " << frame->sequence << " (" << frame->size << " bytes) is " << latency.count() << " us old " << std::endl;
+		return true;
+	}
+	
+	bool StartDriving()
+	{
+		TRACE_SPAN("Drive::StartDriving");
+		while(!GetDataFromSensors()) // only waits for the very first frame after start up
+			std::this_thread::yield();
+		std::cout << " Enjoy the drive " << std::endl;
+		return true;
+	}
+	
+private:
+	Drive(); // needs the sensor frames to read
+	
+	SensorFrameBuffer& _sensorFrames;
+};
+
+class RobotFacade
+{
+public:
+	RobotFacade(SensorFrameBuffer& sensorFrames) : _drive(sensorFrames) { }
+	
+	bool TakeMeToMars()
+	{
+		TRACE_SPAN("RobotFacade::TakeMeToMars");
+		if(_safety.IsSafeForDrive())
+		{
+			_map.FindRoute();
+			_drive.StartDriving();	
+			_map.InvalidateLocation(); // we have moved, the next route starts from wherever we are now
+		}
+		return true;
+	}
+private:
+	Map _map;
+	Drive _drive;
+	Safety _safety;
+};
+
+#endif // FACADE_H
@@ -0,0 +1,61 @@
+// Also called virtual constructor, it helps in defering instantiation of a class. This creation would be done at run time. 
+// Example talks about a console vehicle driving game in the streets. User has the option to choose among a bike, car , truck.
+
+#ifndef FACTORY_H
+#define FACTORY_H
+
+#include<iostream>
+#include<memory>
+
+#include "Trace.h"
+
+namespace factory
+{
+	enum vehicle { BIKE, CAR, TRUCK};
+};
+
+class AbstractVehicle
+{
+public:
+	virtual void drive() = 0;
+};
+
+class Bike:public AbstractVehicle
+{
+public:
+	void drive() { std::cout << " Driving Bike " << std::endl;}
+};
+
+class Car:public AbstractVehicle
+{
+public:
+	void drive() { std::cout << " Driving Car " << std::endl;}
+};
+
+class Truck:public AbstractVehicle
+{
+public:
+	void drive() { std::cout << " Driving Truck " << std::endl;}
+};
+
+class VehicleFactory
+{
+public:
+	static std::shared_ptr<AbstractVehicle> createVehicle(factory::vehicle vehicleType)
+	{
+		TRACE_SPAN("VehicleFactory::createVehicle");
+		switch(vehicleType)
+		{
+			case factory::BIKE:
+				return std::make_shared<Bike>();
+			case factory::CAR:
+				return std::make_shared<Car>();
+			case factory::TRUCK:
+				return std::make_shared<Truck>();
+			default:
+				return nullptr;
+		}
+	}
+};
+
+#endif // FACTORY_H
@@ -1,59 +1,4 @@
-/* Strategy pattern, also known as policy pattern lets users choose one algorithm from a family of interchangable algorithms. It can provide
-   different implementations of same behaviour. Downside is the proliferation of objects
-*/
-
-/* Exmaple shows an application that uses different means to control memory allocation. Assume we have 3 types of memory management used by the
-   application. 1)Memory Pool 2)Controlled via locks 3)Unmanaged. Different modules of the application can choose which theme of memory management
-   it needs. It can also be changed at run time.
-*/
-
-#include<iostream>
-#include<memory>
-
-
-class MemoryManagementTheme
-{
-public:
-	virtual void AllocateMemory(uint) = 0;
-	virtual ~MemoryManagementTheme() { std::cout << " Clean up " << std::endl; }
-}; 
-
-class MemoryPoolAllocator : public MemoryManagementTheme
-{
-public:
-	void AllocateMemory(uint _size)
-	{
-		std::cout << " Memory Pool allocated of size " << _size << std::endl;
-	}
-};
-
-class ControlledMemoryAllocator : public MemoryManagementTheme
-{
-public:
-	void AllocateMemory(uint _size)
-	{
-		std::cout << " Controlled Memory allocated of size " << _size << std::endl;
-	}
-};
-
-class UnmanagedMemoryAllocator : public MemoryManagementTheme
-{
-public:
-	void AllocateMemory(uint _size)
-	{
-		std::cout << " Unmanaged memory allocated of size " << _size << std::endl;
-	}
-};
-	
-class Module
-{
-public:
-	void SetMemoryManagementTheme(std::unique_ptr<MemoryManagementTheme> mmTheme) { _memoryTheme = std::move(mmTheme); }
-	void AllocateMemory(uint _size) { _memoryTheme->AllocateMemory(_size); }
-	void DeAllocateMemory() { _memoryTheme.reset();}
-private:
-	std::unique_ptr<MemoryManagementTheme> _memoryTheme; 
-};	
+#include "Strategy.h"
 
 int main()
 {
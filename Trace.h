@@ -0,0 +1,230 @@
+/* Lightweight tracing of the pattern call boundaries (facade -> subsystem, decorator chains, handler chains, ...).
+   Put TRACE_SPAN("name") at the top of a function and the time spent until the end of the enclosing scope is recorded.
+   The spans can be written out in Chrome's trace event format and opened in chrome://tracing or https://ui.perfetto.dev
+
+   Tracing is switched at compile time. Unless PATTERNS_ENABLE_TRACING is defined (cmake -DPATTERNS_ENABLE_TRACING=ON),
+   TRACE_SPAN expands to nothing and costs nothing.
+
+   A span reads the clock twice, which is most of its cost. The clock is chosen with cmake -DPATTERNS_TRACE_CLOCK=...
+     tsc     the x86 time stamp counter (default on x86; elsewhere falls back to steady)
+     steady  std::chrono::steady_clock, i.e. clock_gettime(CLOCK_MONOTONIC) through the vDSO on Linux
+   benchmarks/TraceBenchmark.cpp times both clocks and a whole span. The target of about 20 ns per span has not been
+   met on any host measured so far; tsc has been the cheaper of the two everywhere.
+*/
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#ifdef PATTERNS_ENABLE_TRACING
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+#if !defined(PATTERNS_TRACE_CLOCK_STEADY) && !defined(PATTERNS_TRACE_CLOCK_TSC)
+#define PATTERNS_TRACE_CLOCK_TSC
+#endif
+#if defined(PATTERNS_TRACE_CLOCK_TSC) && !(defined(__x86_64__) || defined(__i386__))
+#undef PATTERNS_TRACE_CLOCK_TSC
+#define PATTERNS_TRACE_CLOCK_STEADY
+#endif
+
+#if defined(PATTERNS_TRACE_CLOCK_TSC)
+#include <x86intrin.h>
+#endif
+
+namespace trace
+{
+	/* Spans store raw ticks of the chosen clock. steady ticks are nanoseconds already. tsc ticks are converted to
+	   nanoseconds only when the trace is written, by comparing the TSC with steady_clock at start up and at export.
+	   This assumes an invariant TSC, which every recent x86 has
+	*/
+	inline std::uint64_t Ticks()
+	{
+#if defined(PATTERNS_TRACE_CLOCK_TSC)
+		return __rdtsc();
+#else
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+	}
+
+	struct SpanRecord
+	{
+		const char* name; // must be a string literal, only the pointer is stored
+		std::uint64_t begin;
+		std::uint64_t end;
+	};
+
+	// Spans recorded by one thread. When it is full, the oldest spans are overwritten
+	class RingBuffer
+	{
+	public:
+		static const std::size_t CAPACITY = 1 << 16;
+
+		RingBuffer(unsigned threadId) : _threadId(threadId), _count(0) { }
+
+		void Record(const char* name, std::uint64_t begin, std::uint64_t end)
+		{
+			SpanRecord& record = _records[_count++ & (CAPACITY - 1)];
+			record.name = name;
+			record.begin = begin;
+			record.end = end;
+		}
+
+		template <typename Function>
+		void ForEach(Function function) const
+		{
+			std::uint64_t first = _count > CAPACITY ? _count - CAPACITY : 0;
+			for(std::uint64_t i = first; i < _count; ++i)
+				function(_records[i & (CAPACITY - 1)]);
+		}
+
+		unsigned ThreadId() const { return _threadId; }
+
+	private:
+		unsigned _threadId;
+		std::uint64_t _count;
+		std::array<SpanRecord, CAPACITY> _records;
+	};
+
+	/* Owns the buffers of all threads, so the spans outlive the threads that recorded them. When a thread exits its buffer
+	   goes back to a free list and the next new thread records into it, so memory is bounded by the number of threads
+	   alive at once, not by how many have come and gone. A "tid" in the trace is therefore a buffer, not an OS thread
+	*/
+	class Registry
+	{
+	public:
+		static Registry& Instance()
+		{
+			static Registry registry;
+			return registry;
+		}
+
+		RingBuffer& AcquireBuffer()
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			if(!_freeBuffers.empty())
+			{
+				RingBuffer* buffer = _freeBuffers.back();
+				_freeBuffers.pop_back();
+				return *buffer;
+			}
+			_buffers.push_back(std::unique_ptr<RingBuffer>(new RingBuffer(static_cast<unsigned>(_buffers.size() + 1))));
+			return *_buffers.back();
+		}
+
+		void ReleaseBuffer(RingBuffer& buffer)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_freeBuffers.push_back(&buffer);
+		}
+
+		// Not synchronised with the recording threads. Write the trace once the traced work is done
+		void WriteChromeTrace(std::ostream& out)
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			double nsPerTick = NsPerTick();
+
+			// Chrome wants microseconds
+			auto toMicroseconds = [&](std::uint64_t ticks) { return (static_cast<double>(ticks) - _ticksAtStart) * nsPerTick / 1000.0; };
+
+			std::ios_base::fmtflags flags = out.flags();
+			std::streamsize precision = out.precision();
+			out << std::fixed << std::setprecision(3); // nanosecond resolution
+			out << "{\"traceEvents\":[";
+			const char* separator = "\n";
+			for(auto& buffer : _buffers)
+			{
+				unsigned threadId = buffer->ThreadId();
+				buffer->ForEach([&](const SpanRecord& record)
+				{
+					out << separator << "{\"name\":\"" << record.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << threadId
+						<< ",\"ts\":" << toMicroseconds(record.begin) << ",\"dur\":" << (record.end - record.begin) * nsPerTick / 1000.0 << "}";
+					separator = ",\n";
+				});
+			}
+			out << "\n],\"displayTimeUnit\":\"ns\"}" << std::endl;
+			out.flags(flags);
+			out.precision(precision);
+		}
+
+	private:
+		Registry() : _ticksAtStart(Ticks()), _clockAtStart(std::chrono::steady_clock::now()) { }
+
+		double NsPerTick() const
+		{
+#if defined(PATTERNS_TRACE_CLOCK_TSC)
+			std::uint64_t ticksNow = Ticks();
+			std::chrono::steady_clock::time_point clockNow = std::chrono::steady_clock::now();
+			if(ticksNow == _ticksAtStart) // nothing to calibrate against yet, and no span can have a duration either
+				return 1.0;
+			return std::chrono::duration<double, std::nano>(clockNow - _clockAtStart).count() / (ticksNow - _ticksAtStart);
+#else
+			return 1.0;
+#endif
+		}
+
+		std::mutex _mutex;
+		std::vector<std::unique_ptr<RingBuffer>> _buffers;
+		std::vector<RingBuffer*> _freeBuffers; // buffers of threads that have exited, spans kept
+		std::uint64_t _ticksAtStart;
+		std::chrono::steady_clock::time_point _clockAtStart;
+	};
+
+	// Holds the calling thread's buffer and hands it back to the registry when the thread exits
+	class ThreadBufferOwner
+	{
+	public:
+		ThreadBufferOwner() : _buffer(Registry::Instance().AcquireBuffer()) { }
+		~ThreadBufferOwner() { Registry::Instance().ReleaseBuffer(_buffer); }
+		RingBuffer& Buffer() { return _buffer; }
+
+	private:
+		ThreadBufferOwner(const ThreadBufferOwner&);
+		ThreadBufferOwner& operator =(const ThreadBufferOwner&);
+
+		RingBuffer& _buffer;
+	};
+
+	inline RingBuffer& ThreadBuffer()
+	{
+		thread_local ThreadBufferOwner owner;
+		return owner.Buffer();
+	}
+
+	// Records the time between its construction and destruction
+	class Span
+	{
+	public:
+		explicit Span(const char* name) : _buffer(ThreadBuffer()), _name(name), _begin(Ticks()) { }
+		~Span() { _buffer.Record(_name, _begin, Ticks()); }
+
+	private:
+		Span(const Span&);
+		Span& operator =(const Span&);
+
+		RingBuffer& _buffer; // looked up first, so the registry's start time is older than any span
+		const char* _name;
+		std::uint64_t _begin;
+	};
+
+	inline void WriteChromeTrace(std::ostream& out) { Registry::Instance().WriteChromeTrace(out); }
+}
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+#define TRACE_SPAN(name) trace::Span TRACE_CONCAT(_traceSpan, __LINE__)(name)
+
+#else
+
+#define TRACE_SPAN(name) do { } while(0)
+
+#endif // PATTERNS_ENABLE_TRACING
+
+#endif // TRACE_H
@@ -0,0 +1,19 @@
+#include "AbstractFactory.h"
+
+#include <benchmark/benchmark.h>
+
+template <typename CarFactory>
+static void BM_AbstractCarFactoryCreateParts(benchmark::State& state)
+{
+	CarFactory car;
+	AbstractCarFactory& carFactory = car; // go through the abstract factory, as the clients do
+	for(auto _ : state)
+	{
+		std::shared_ptr<AbstractCarDoor> door = carFactory.createDoor();
+		std::shared_ptr<AbstractCarSteering> steering = carFactory.createSteering();
+		benchmark::DoNotOptimize(door);
+		benchmark::DoNotOptimize(steering);
+	}
+}
+BENCHMARK_TEMPLATE(BM_AbstractCarFactoryCreateParts, HoldenCar);
+BENCHMARK_TEMPLATE(BM_AbstractCarFactoryCreateParts, HondaCar);
@@ -0,0 +1,35 @@
+/* The pattern classes print what they are doing to std::cout. That is nice in the demos, but it would flood the benchmark
+   report, so std::cout is pointed at a sink that drops everything and the reports are written to the real console instead.
+   The classes still pay for formatting their output, just as they do in the demos.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <iostream>
+#include <streambuf>
+
+class NullBuffer : public std::streambuf
+{
+protected:
+	int overflow(int c) { return traits_type::not_eof(c); }
+	std::streamsize xsputn(const char*, std::streamsize count) { return count; }
+};
+
+int main(int argc, char** argv)
+{
+	benchmark::Initialize(&argc, argv);
+	if(benchmark::ReportUnrecognizedArguments(argc, argv))
+		return 1;
+	
+	NullBuffer sink;
+	std::ostream console(std::cout.rdbuf(&sink));
+	
+	benchmark::ConsoleReporter reporter;
+	reporter.SetOutputStream(&console);
+	reporter.SetErrorStream(&console);
+	benchmark::RunSpecifiedBenchmarks(&reporter);
+	
+	std::cout.rdbuf(console.rdbuf());
+	benchmark::Shutdown();
+	return 0;
+}
@@ -0,0 +1,14 @@
+#include "ChainOfResponsibility.h"
+
+#include <benchmark/benchmark.h>
+
+// The same chain the Team builds. Larger targets walk further down the chain
+static void BM_BatsmanChase(benchmark::State& state)
+{
+	std::shared_ptr<Batsman> opener = std::make_shared<Opener>(std::make_shared<MiddleOrder>(std::make_shared<TailEnder>()));
+	int target = static_cast<int>(state.range(0));
+	std::srand(1); // same sequence of scores on every run
+	for(auto _ : state)
+		benchmark::DoNotOptimize(opener->Chase(target));
+}
+BENCHMARK(BM_BatsmanChase)->Arg(1)->Arg(100)->Arg(200);
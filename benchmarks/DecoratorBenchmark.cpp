@@ -0,0 +1,20 @@
+#include "Decorator.h"
+
+#include <benchmark/benchmark.h>
+
+// Waffle wrapped in range(0) decorators, alternating between the two dressings
+static void BM_DecoratorComputeCost(benchmark::State& state)
+{
+	std::unique_ptr<AbstractDessert> dessert(new Waffle());
+	for(int i = 0; i < state.range(0); ++i)
+	{
+		if(i % 2)
+			dessert = std::unique_ptr<AbstractDessert>(new MoltenCaramel(std::move(dessert)));
+		else
+			dessert = std::unique_ptr<AbstractDessert>(new ChocolateShavings(std::move(dessert)));
+	}
+	
+	for(auto _ : state)
+		benchmark::DoNotOptimize(dessert->computeCost());
+}
+BENCHMARK(BM_DecoratorComputeCost)->Arg(0)->Arg(1)->Arg(2)->Arg(8)->Arg(32);
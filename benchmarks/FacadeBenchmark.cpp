@@ -0,0 +1,83 @@
+#include "Facade.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+// range(0) is the size of the route cache. With no cache every lookup is a miss
+static void BM_MapFindRoute(benchmark::State& state)
+{
+	Map map(static_cast<std::size_t>(state.range(0)));
+	map.FindRoute("Mars");
+	for(auto _ : state)
+		benchmark::DoNotOptimize(map.FindRoute("Mars"));
+}
+BENCHMARK(BM_MapFindRoute)->Arg(0)->Arg(8);
+
+// Many callers sharing one Safety. range(0) is the staleness window in ms; with 0 nearly every call needs a hardware read,
+// and callers arriving during a read share it. hw_reads is the number of hardware reads per second across all callers
+static void BM_SafetyIsSafeForDrive(benchmark::State& state)
+{
+	static Safety* safety = nullptr;
+	if(state.thread_index() == 0)
+		safety = new Safety(std::chrono::milliseconds(state.range(0)));
+	// the loop starts and ends with a barrier across the threads, so the setup above and the teardown below are safe
+	for(auto _ : state)
+		benchmark::DoNotOptimize(safety->IsSafeForDrive());
+	if(state.thread_index() == 0)
+	{
+		state.counters["hw_reads"] = benchmark::Counter(static_cast<double>(safety->HardwareReads()), benchmark::Counter::kIsRate);
+		delete safety;
+		safety = nullptr;
+	}
+}
+BENCHMARK(BM_SafetyIsSafeForDrive)->Arg(0)->Arg(100)->ThreadRange(1, 8)->UseRealTime();
+
+// Publish and consume on the same thread, i.e. the cost of the two atomic swaps without contention
+static void BM_SensorFrameBufferPublishAndConsume(benchmark::State& state)
+{
+	SensorFrameBuffer buffer(1 << 20);
+	for(auto _ : state)
+	{
+		buffer.BackFrame().sequence++;
+		buffer.Publish();
+		benchmark::DoNotOptimize(buffer.LatestFrame());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SensorFrameBufferPublishAndConsume);
+
+// A SensorReplay producer thread publishing every range(0) microseconds while this thread consumes the latest frame,
+// as Drive does. Reports the frames actually consumed per second and how old they were when consumed
+static void BM_SensorReplayEndToEnd(benchmark::State& state)
+{
+	const std::size_t frameSize = 1 << 20;
+	SensorFrameBuffer buffer(frameSize);
+	SensorReplay replay(buffer, std::vector<std::vector<unsigned char>>(4, std::vector<unsigned char>(frameSize)),
+		std::chrono::microseconds(state.range(0)));
+	
+	std::vector<double> latenciesUs;
+	unsigned long lastSequence = 0;
+	replay.Start();
+	for(auto _ : state)
+	{
+		const SensorFrame* frame = buffer.LatestFrame();
+		if(frame && frame->sequence != lastSequence)
+		{
+			lastSequence = frame->sequence;
+			latenciesUs.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - frame->captured).count());
+		}
+	}
+	replay.Stop();
+	
+	state.counters["frames"] = benchmark::Counter(static_cast<double>(latenciesUs.size()), benchmark::Counter::kIsRate);
+	if(!latenciesUs.empty())
+	{
+		std::sort(latenciesUs.begin(), latenciesUs.end());
+		state.counters["latency_mean_us"] = std::accumulate(latenciesUs.begin(), latenciesUs.end(), 0.0) / latenciesUs.size();
+		state.counters["latency_p99_us"] = latenciesUs[latenciesUs.size() * 99 / 100];
+	}
+}
+BENCHMARK(BM_SensorReplayEndToEnd)->Arg(100)->Arg(1000)->MinTime(0.5)->UseRealTime();
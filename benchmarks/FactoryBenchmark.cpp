@@ -0,0 +1,14 @@
+#include "Factory.h"
+
+#include <benchmark/benchmark.h>
+
+static void BM_VehicleFactoryCreateVehicle(benchmark::State& state)
+{
+	factory::vehicle vehicleType = static_cast<factory::vehicle>(state.range(0));
+	for(auto _ : state)
+	{
+		std::shared_ptr<AbstractVehicle> vehicle = VehicleFactory::createVehicle(vehicleType);
+		benchmark::DoNotOptimize(vehicle);
+	}
+}
+BENCHMARK(BM_VehicleFactoryCreateVehicle)->Arg(factory::BIKE)->Arg(factory::CAR)->Arg(factory::TRUCK);
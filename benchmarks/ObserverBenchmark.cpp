@@ -0,0 +1,24 @@
+#include "Observer.h"
+
+#include <benchmark/benchmark.h>
+
+// One publisher notifying range(0) observers
+static void BM_NotifyHwMonitorResults(benchmark::State& state)
+{
+	auto publisher = std::make_shared<HwMonitorPublisher>();
+	std::vector<std::shared_ptr<HwMonitorObserver>> observers;
+	for(int i = 0; i < state.range(0); ++i)
+	{
+		observers.push_back(std::make_shared<FaultReporter>(publisher));
+		publisher->RegisterObserver(observers.back());
+	}
+	
+	for(auto _ : state)
+		publisher->NotifyHwMonitorResults();
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	
+	// the observers hold the publisher, break the cycle
+	for(auto& observer : observers)
+		publisher->DeRegisterObserver(observer);
+}
+BENCHMARK(BM_NotifyHwMonitorResults)->Arg(1)->Arg(3)->Arg(16)->Arg(128);
@@ -0,0 +1,22 @@
+#include "Singleton.h"
+
+#include <benchmark/benchmark.h>
+
+static void BM_PowerMonitorControllerGetInstance(benchmark::State& state)
+{
+	// Create the instance before the threads race on it. This one is not thread safe
+	static std::shared_ptr<PowerMonitorController> created = PowerMonitorController::GetInstance();
+	for(auto _ : state)
+	{
+		std::shared_ptr<PowerMonitorController> instance = PowerMonitorController::GetInstance();
+		benchmark::DoNotOptimize(instance);
+	}
+}
+BENCHMARK(BM_PowerMonitorControllerGetInstance)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_ThreadSafePowerMonitorControllerGetInstance(benchmark::State& state)
+{
+	for(auto _ : state)
+		benchmark::DoNotOptimize(&ThreadSafePowerMonitorController::GetInstance());
+}
+BENCHMARK(BM_ThreadSafePowerMonitorControllerGetInstance)->ThreadRange(1, 8)->UseRealTime();
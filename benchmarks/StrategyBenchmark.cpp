@@ -0,0 +1,15 @@
+#include "Strategy.h"
+
+#include <benchmark/benchmark.h>
+
+template <typename Theme>
+static void BM_ModuleAllocateMemory(benchmark::State& state)
+{
+	Module module;
+	module.SetMemoryManagementTheme(std::unique_ptr<Theme>(new Theme()));
+	for(auto _ : state)
+		module.AllocateMemory(static_cast<uint>(state.range(0)));
+}
+BENCHMARK_TEMPLATE(BM_ModuleAllocateMemory, MemoryPoolAllocator)->Arg(64);
+BENCHMARK_TEMPLATE(BM_ModuleAllocateMemory, ControlledMemoryAllocator)->Arg(64);
+BENCHMARK_TEMPLATE(BM_ModuleAllocateMemory, UnmanagedMemoryAllocator)->Arg(64);
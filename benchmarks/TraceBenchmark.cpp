@@ -0,0 +1,37 @@
+#include "Trace.h"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Cost of one empty span. Zero unless built with PATTERNS_ENABLE_TRACING
+static void BM_TraceSpan(benchmark::State& state)
+{
+	for(auto _ : state)
+	{
+		TRACE_SPAN("BM_TraceSpan");
+		benchmark::ClobberMemory();
+	}
+}
+BENCHMARK(BM_TraceSpan);
+
+// The clocks PATTERNS_TRACE_CLOCK can choose from. A span reads one twice, so pick the cheapest on your host
+
+#if defined(__x86_64__) || defined(__i386__)
+static void BM_TraceClockTsc(benchmark::State& state)
+{
+	for(auto _ : state)
+		benchmark::DoNotOptimize(__rdtsc());
+}
+BENCHMARK(BM_TraceClockTsc);
+#endif
+
+static void BM_TraceClockSteady(benchmark::State& state)
+{
+	for(auto _ : state)
+		benchmark::DoNotOptimize(std::chrono::steady_clock::now());
+}
+BENCHMARK(BM_TraceClockSteady);